@@ -161,19 +161,51 @@ struct user_config_s {
 #endif
 	_Bool collect_totals;
 	_Bool collect_workers;
+
+	/* Adaptive interval settings */
+	_Bool adaptive_interval;
+	int min_interval;
+	int max_interval;
+	int active_rate;
+
+	/* Adaptive interval state */
+	int interval;
+	time_t next_poll;
+	time_t poll_time;
+	time_t last_poll;
+	uint64_t last_client_req;
+	uint64_t last_backend_fail;
+	uint64_t last_n_wrk_drop;
+	double last_req_rate;
 };
 typedef struct user_config_s user_config_t; /* }}} */
 
 static _Bool have_instance = 0;
 
-static int varnish_submit (const char *plugin_instance, /* {{{ */
+/* Adaptive instances are registered from varnish_init, once the global
+ * "Interval" is known. */
+static user_config_t **adaptive_instances = NULL;
+static size_t adaptive_instances_num = 0;
+
+static int varnish_submit (const user_config_t *conf, /* {{{ */
 		const char *category, const char *type, const char *type_instance, value_t value)
 {
 	value_list_t vl = VALUE_LIST_INIT;
+	const char *plugin_instance = conf->instance;
 
 	vl.values = &value;
 	vl.values_len = 1;
 
+	/* Stamp adaptive samples with their slot on the poll grid. Backed-off
+	 * samples announce the longer interval so the value cache does not
+	 * time them out; faster ones keep the configured step. */
+	if (conf->adaptive_interval)
+	{
+		vl.time = conf->poll_time;
+		if (conf->interval > interval_g)
+			vl.interval = conf->interval;
+	}
+
 	sstrncpy (vl.host, hostname_g, sizeof (vl.host));
 
 	sstrncpy (vl.plugin, "varnish", sizeof (vl.plugin));
@@ -193,7 +225,7 @@ static int varnish_submit (const char *plugin_instance, /* {{{ */
 	return (plugin_dispatch_values (&vl));
 } /* }}} int varnish_submit */
 
-static int varnish_submit_gauge (const char *plugin_instance, /* {{{ */
+static int varnish_submit_gauge (const user_config_t *conf, /* {{{ */
 		const char *category, const char *type, const char *type_instance,
 		uint64_t gauge_value)
 {
@@ -201,10 +233,10 @@ static int varnish_submit_gauge (const char *plugin_instance, /* {{{ */
 
 	value.gauge = (gauge_t) gauge_value;
 
-	return (varnish_submit (plugin_instance, category, type, type_instance, value));
+	return (varnish_submit (conf, category, type, type_instance, value));
 } /* }}} int varnish_submit_gauge */
 
-static int varnish_submit_derive (const char *plugin_instance, /* {{{ */
+static int varnish_submit_derive (const user_config_t *conf, /* {{{ */
 		const char *category, const char *type, const char *type_instance,
 		uint64_t derive_value)
 {
@@ -212,7 +244,7 @@ static int varnish_submit_derive (const char *plugin_instance, /* {{{ */
 
 	value.derive = (derive_t) derive_value;
 
-	return (varnish_submit (plugin_instance, category, type, type_instance, value));
+	return (varnish_submit (conf, category, type, type_instance, value));
 } /* }}} int varnish_submit_derive */
 
 #if HAVE_VARNISH_V2
@@ -225,182 +257,364 @@ static void varnish_monitor (const user_config_t *conf, const struct VSC_C_main
 	if (conf->collect_cache)
 	{
 		/* Cache hits */
-		varnish_submit_derive (conf->instance, "cache", "cache_result", "hit",     STAT_STRUCT->cache_hit);
+		varnish_submit_derive (conf, "cache", "cache_result", "hit",     STAT_STRUCT->cache_hit);
 		/* Cache misses */
-		varnish_submit_derive (conf->instance, "cache", "cache_result", "miss",    STAT_STRUCT->cache_miss);
+		varnish_submit_derive (conf, "cache", "cache_result", "miss",    STAT_STRUCT->cache_miss);
 		/* Cache hits for pass */
-		varnish_submit_derive (conf->instance, "cache", "cache_result", "hitpass", STAT_STRUCT->cache_hitpass);
+		varnish_submit_derive (conf, "cache", "cache_result", "hitpass", STAT_STRUCT->cache_hitpass);
 	}
 
 	if (conf->collect_connections)
 	{
 		/* Client connections accepted */
-		varnish_submit_derive (conf->instance, "connections", "connections", "accepted", STAT_STRUCT->client_conn);
+		varnish_submit_derive (conf, "connections", "connections", "accepted", STAT_STRUCT->client_conn);
 		/* Connection dropped, no sess */
-		varnish_submit_derive (conf->instance, "connections", "connections", "dropped" , STAT_STRUCT->client_drop);
+		varnish_submit_derive (conf, "connections", "connections", "dropped" , STAT_STRUCT->client_drop);
 		/* Client requests received    */
-		varnish_submit_derive (conf->instance, "connections", "connections", "received", STAT_STRUCT->client_req);
+		varnish_submit_derive (conf, "connections", "connections", "received", STAT_STRUCT->client_req);
 	}
 
 	if (conf->collect_esi)
 	{
 #if HAVE_VARNISH_V2
 		/* Objects ESI parsed (unlock) */
-		varnish_submit_derive (conf->instance, "esi", "total_operations", "parsed", STAT_STRUCT->esi_parse);
+		varnish_submit_derive (conf, "esi", "total_operations", "parsed", STAT_STRUCT->esi_parse);
 #endif
 		/* ESI parse errors (unlock)   */
-		varnish_submit_derive (conf->instance, "esi", "total_operations", "error",  STAT_STRUCT->esi_errors);
+		varnish_submit_derive (conf, "esi", "total_operations", "error",  STAT_STRUCT->esi_errors);
 	}
 
 	if (conf->collect_backend)
 	{
 		/* Backend conn. success       */
-		varnish_submit_derive (conf->instance, "backend", "connections", "success"      , STAT_STRUCT->backend_conn);
+		varnish_submit_derive (conf, "backend", "connections", "success"      , STAT_STRUCT->backend_conn);
 		/* Backend conn. not attempted */
-		varnish_submit_derive (conf->instance, "backend", "connections", "not-attempted", STAT_STRUCT->backend_unhealthy);
+		varnish_submit_derive (conf, "backend", "connections", "not-attempted", STAT_STRUCT->backend_unhealthy);
 		/* Backend conn. too many      */
-		varnish_submit_derive (conf->instance, "backend", "connections", "too-many"     , STAT_STRUCT->backend_busy);
+		varnish_submit_derive (conf, "backend", "connections", "too-many"     , STAT_STRUCT->backend_busy);
 		/* Backend conn. failures      */
-		varnish_submit_derive (conf->instance, "backend", "connections", "failures"     , STAT_STRUCT->backend_fail);
+		varnish_submit_derive (conf, "backend", "connections", "failures"     , STAT_STRUCT->backend_fail);
 		/* Backend conn. reuses        */
-		varnish_submit_derive (conf->instance, "backend", "connections", "reuses"       , STAT_STRUCT->backend_reuse);
+		varnish_submit_derive (conf, "backend", "connections", "reuses"       , STAT_STRUCT->backend_reuse);
 		/* Backend conn. was closed    */
-		varnish_submit_derive (conf->instance, "backend", "connections", "was-closed"   , STAT_STRUCT->backend_toolate);
+		varnish_submit_derive (conf, "backend", "connections", "was-closed"   , STAT_STRUCT->backend_toolate);
 		/* Backend conn. recycles      */
-		varnish_submit_derive (conf->instance, "backend", "connections", "recycled"     , STAT_STRUCT->backend_recycle);
+		varnish_submit_derive (conf, "backend", "connections", "recycled"     , STAT_STRUCT->backend_recycle);
 #if HAVE_VARNISH_V2
 		/* Backend conn. unused        */
-		varnish_submit_derive (conf->instance, "backend", "connections", "unused"       , STAT_STRUCT->backend_unused);
+		varnish_submit_derive (conf, "backend", "connections", "unused"       , STAT_STRUCT->backend_unused);
 #endif
 	}
 
 	if (conf->collect_fetch)
 	{
 		/* Fetch head                */
-		varnish_submit_derive (conf->instance, "fetch", "http_requests", "head"       , STAT_STRUCT->fetch_head);
+		varnish_submit_derive (conf, "fetch", "http_requests", "head"       , STAT_STRUCT->fetch_head);
 		/* Fetch with length         */
-		varnish_submit_derive (conf->instance, "fetch", "http_requests", "length"     , STAT_STRUCT->fetch_length);
+		varnish_submit_derive (conf, "fetch", "http_requests", "length"     , STAT_STRUCT->fetch_length);
 		/* Fetch chunked             */
-		varnish_submit_derive (conf->instance, "fetch", "http_requests", "chunked"    , STAT_STRUCT->fetch_chunked);
+		varnish_submit_derive (conf, "fetch", "http_requests", "chunked"    , STAT_STRUCT->fetch_chunked);
 		/* Fetch EOF                 */
-		varnish_submit_derive (conf->instance, "fetch", "http_requests", "eof"        , STAT_STRUCT->fetch_eof);
+		varnish_submit_derive (conf, "fetch", "http_requests", "eof"        , STAT_STRUCT->fetch_eof);
 		/* Fetch bad headers         */
-		varnish_submit_derive (conf->instance, "fetch", "http_requests", "bad_headers", STAT_STRUCT->fetch_bad);
+		varnish_submit_derive (conf, "fetch", "http_requests", "bad_headers", STAT_STRUCT->fetch_bad);
 		/* Fetch wanted close        */
-		varnish_submit_derive (conf->instance, "fetch", "http_requests", "close"      , STAT_STRUCT->fetch_close);
+		varnish_submit_derive (conf, "fetch", "http_requests", "close"      , STAT_STRUCT->fetch_close);
 		/* Fetch pre HTTP/1.1 closed */
-		varnish_submit_derive (conf->instance, "fetch", "http_requests", "oldhttp"    , STAT_STRUCT->fetch_oldhttp);
+		varnish_submit_derive (conf, "fetch", "http_requests", "oldhttp"    , STAT_STRUCT->fetch_oldhttp);
 		/* Fetch zero len            */
-		varnish_submit_derive (conf->instance, "fetch", "http_requests", "zero"       , STAT_STRUCT->fetch_zero);
+		varnish_submit_derive (conf, "fetch", "http_requests", "zero"       , STAT_STRUCT->fetch_zero);
 		/* Fetch failed              */
-		varnish_submit_derive (conf->instance, "fetch", "http_requests", "failed"     , STAT_STRUCT->fetch_failed);
+		varnish_submit_derive (conf, "fetch", "http_requests", "failed"     , STAT_STRUCT->fetch_failed);
 	}
 
 	if (conf->collect_hcb)
 	{
 		/* HCB Lookups without lock */
-		varnish_submit_derive (conf->instance, "hcb", "cache_operation", "lookup_nolock", STAT_STRUCT->hcb_nolock);
+		varnish_submit_derive (conf, "hcb", "cache_operation", "lookup_nolock", STAT_STRUCT->hcb_nolock);
 		/* HCB Lookups with lock    */
-		varnish_submit_derive (conf->instance, "hcb", "cache_operation", "lookup_lock",   STAT_STRUCT->hcb_lock);
+		varnish_submit_derive (conf, "hcb", "cache_operation", "lookup_lock",   STAT_STRUCT->hcb_lock);
 		/* HCB Inserts              */
-		varnish_submit_derive (conf->instance, "hcb", "cache_operation", "insert",        STAT_STRUCT->hcb_insert);
+		varnish_submit_derive (conf, "hcb", "cache_operation", "insert",        STAT_STRUCT->hcb_insert);
 	}
 
 	if (conf->collect_shm)
 	{
 		/* SHM records                 */
-		varnish_submit_derive (conf->instance, "shm", "total_operations", "records"   , STAT_STRUCT->shm_records);
+		varnish_submit_derive (conf, "shm", "total_operations", "records"   , STAT_STRUCT->shm_records);
 		/* SHM writes                  */
-		varnish_submit_derive (conf->instance, "shm", "total_operations", "writes"    , STAT_STRUCT->shm_writes);
+		varnish_submit_derive (conf, "shm", "total_operations", "writes"    , STAT_STRUCT->shm_writes);
 		/* SHM flushes due to overflow */
-		varnish_submit_derive (conf->instance, "shm", "total_operations", "flushes"   , STAT_STRUCT->shm_flushes);
+		varnish_submit_derive (conf, "shm", "total_operations", "flushes"   , STAT_STRUCT->shm_flushes);
 		/* SHM MTX contention          */
-		varnish_submit_derive (conf->instance, "shm", "total_operations", "contention", STAT_STRUCT->shm_cont);
+		varnish_submit_derive (conf, "shm", "total_operations", "contention", STAT_STRUCT->shm_cont);
 		/* SHM cycles through buffer   */
-		varnish_submit_derive (conf->instance, "shm", "total_operations", "cycles"    , STAT_STRUCT->shm_cycles);
+		varnish_submit_derive (conf, "shm", "total_operations", "cycles"    , STAT_STRUCT->shm_cycles);
 	}
 
 #if HAVE_VARNISH_V2
 	if (conf->collect_sm)
 	{
 		/* allocator requests */
-		varnish_submit_derive (conf->instance, "sm", "total_requests", "nreq",  STAT_STRUCT->sm_nreq);
+		varnish_submit_derive (conf, "sm", "total_requests", "nreq",  STAT_STRUCT->sm_nreq);
 		/* outstanding allocations */
-		varnish_submit_gauge (conf->instance,  "sm", "requests", "outstanding", STAT_STRUCT->sm_nobj);
+		varnish_submit_gauge (conf,  "sm", "requests", "outstanding", STAT_STRUCT->sm_nobj);
 		/* bytes allocated */
-		varnish_submit_derive (conf->instance,  "sm", "total_bytes", "allocated",      STAT_STRUCT->sm_balloc);
+		varnish_submit_derive (conf,  "sm", "total_bytes", "allocated",      STAT_STRUCT->sm_balloc);
 		/* bytes free */
-		varnish_submit_derive (conf->instance,  "sm", "total_bytes", "free",           STAT_STRUCT->sm_bfree);
+		varnish_submit_derive (conf,  "sm", "total_bytes", "free",           STAT_STRUCT->sm_bfree);
 	}
 
 	if (conf->collect_sma)
 	{
 		/* SMA allocator requests */
-		varnish_submit_derive (conf->instance, "sma", "total_requests", "nreq",  STAT_STRUCT->sma_nreq);
+		varnish_submit_derive (conf, "sma", "total_requests", "nreq",  STAT_STRUCT->sma_nreq);
 		/* SMA outstanding allocations */
-		varnish_submit_gauge (conf->instance,  "sma", "requests", "outstanding", STAT_STRUCT->sma_nobj);
+		varnish_submit_gauge (conf,  "sma", "requests", "outstanding", STAT_STRUCT->sma_nobj);
 		/* SMA outstanding bytes */
-		varnish_submit_gauge (conf->instance,  "sma", "bytes", "outstanding",    STAT_STRUCT->sma_nbytes);
+		varnish_submit_gauge (conf,  "sma", "bytes", "outstanding",    STAT_STRUCT->sma_nbytes);
 		/* SMA bytes allocated */
-		varnish_submit_derive (conf->instance,  "sma", "total_bytes", "allocated",      STAT_STRUCT->sma_balloc);
+		varnish_submit_derive (conf,  "sma", "total_bytes", "allocated",      STAT_STRUCT->sma_balloc);
 		/* SMA bytes free */
-		varnish_submit_derive (conf->instance,  "sma", "total_bytes", "free" ,          STAT_STRUCT->sma_bfree);
+		varnish_submit_derive (conf,  "sma", "total_bytes", "free" ,          STAT_STRUCT->sma_bfree);
 	}
 #endif
 
 	if (conf->collect_sms)
 	{
 		/* SMS allocator requests */
-		varnish_submit_derive (conf->instance, "sms", "total_requests", "allocator", STAT_STRUCT->sms_nreq);
+		varnish_submit_derive (conf, "sms", "total_requests", "allocator", STAT_STRUCT->sms_nreq);
 		/* SMS outstanding allocations */
-		varnish_submit_gauge (conf->instance,  "sms", "requests", "outstanding",     STAT_STRUCT->sms_nobj);
+		varnish_submit_gauge (conf,  "sms", "requests", "outstanding",     STAT_STRUCT->sms_nobj);
 		/* SMS outstanding bytes */
-		varnish_submit_gauge (conf->instance,  "sms", "bytes", "outstanding",        STAT_STRUCT->sms_nbytes);
+		varnish_submit_gauge (conf,  "sms", "bytes", "outstanding",        STAT_STRUCT->sms_nbytes);
 		/* SMS bytes allocated */
-		varnish_submit_derive (conf->instance,  "sms", "total_bytes", "allocated",          STAT_STRUCT->sms_balloc);
+		varnish_submit_derive (conf,  "sms", "total_bytes", "allocated",          STAT_STRUCT->sms_balloc);
 		/* SMS bytes freed */
-		varnish_submit_derive (conf->instance,  "sms", "total_bytes", "free",               STAT_STRUCT->sms_bfree);
+		varnish_submit_derive (conf,  "sms", "total_bytes", "free",               STAT_STRUCT->sms_bfree);
 	}
 
 	if (conf->collect_totals)
 	{
 		/* Total Sessions */
-		varnish_submit_derive (conf->instance, "totals", "total_sessions", "sessions",  STAT_STRUCT->s_sess);
+		varnish_submit_derive (conf, "totals", "total_sessions", "sessions",  STAT_STRUCT->s_sess);
 		/* Total Requests */
-		varnish_submit_derive (conf->instance, "totals", "total_requests", "requests",  STAT_STRUCT->s_req);
+		varnish_submit_derive (conf, "totals", "total_requests", "requests",  STAT_STRUCT->s_req);
 		/* Total pipe */
-		varnish_submit_derive (conf->instance, "totals", "total_operations", "pipe",    STAT_STRUCT->s_pipe);
+		varnish_submit_derive (conf, "totals", "total_operations", "pipe",    STAT_STRUCT->s_pipe);
 		/* Total pass */
-		varnish_submit_derive (conf->instance, "totals", "total_operations", "pass",    STAT_STRUCT->s_pass);
+		varnish_submit_derive (conf, "totals", "total_operations", "pass",    STAT_STRUCT->s_pass);
 		/* Total fetch */
-		varnish_submit_derive (conf->instance, "totals", "total_operations", "fetches", STAT_STRUCT->s_fetch);
+		varnish_submit_derive (conf, "totals", "total_operations", "fetches", STAT_STRUCT->s_fetch);
 		/* Total header bytes */
-		varnish_submit_derive (conf->instance, "totals", "total_bytes", "header-bytes", STAT_STRUCT->s_hdrbytes);
+		varnish_submit_derive (conf, "totals", "total_bytes", "header-bytes", STAT_STRUCT->s_hdrbytes);
 		/* Total body byte */
-		varnish_submit_derive (conf->instance, "totals", "total_bytes", "body-bytes",   STAT_STRUCT->s_bodybytes);
+		varnish_submit_derive (conf, "totals", "total_bytes", "body-bytes",   STAT_STRUCT->s_bodybytes);
 	}
 
 	if (conf->collect_workers)
 	{
 		/* worker threads */
-		varnish_submit_gauge (conf->instance, "workers", "threads", "worker",            STAT_STRUCT->n_wrk);
+		varnish_submit_gauge (conf, "workers", "threads", "worker",            STAT_STRUCT->n_wrk);
 		/* worker threads created */
-		varnish_submit_derive (conf->instance, "workers", "total_threads", "created",     STAT_STRUCT->n_wrk_create);
+		varnish_submit_derive (conf, "workers", "total_threads", "created",     STAT_STRUCT->n_wrk_create);
 		/* worker threads not created */
-		varnish_submit_derive (conf->instance, "workers", "total_threads", "failed",      STAT_STRUCT->n_wrk_failed);
+		varnish_submit_derive (conf, "workers", "total_threads", "failed",      STAT_STRUCT->n_wrk_failed);
 		/* worker threads limited */
-		varnish_submit_derive (conf->instance, "workers", "total_threads", "limited",     STAT_STRUCT->n_wrk_max);
+		varnish_submit_derive (conf, "workers", "total_threads", "limited",     STAT_STRUCT->n_wrk_max);
 #ifdef HAVE_VARNISH_V2
 		/* queued work requests */
-		varnish_submit_derive (conf->instance, "workers", "total_requests", "queued",     STAT_STRUCT->n_wrk_queue);
+		varnish_submit_derive (conf, "workers", "total_requests", "queued",     STAT_STRUCT->n_wrk_queue);
 		/* overflowed work requests */
-		varnish_submit_derive (conf->instance, "workers", "total_requests", "overflowed", STAT_STRUCT->n_wrk_overflow);
+		varnish_submit_derive (conf, "workers", "total_requests", "overflowed", STAT_STRUCT->n_wrk_overflow);
 #endif
 		/* dropped work requests */
-		varnish_submit_derive (conf->instance, "workers", "total_requests", "dropped",    STAT_STRUCT->n_wrk_drop);
+		varnish_submit_derive (conf, "workers", "total_requests", "dropped",    STAT_STRUCT->n_wrk_drop);
 	}
 } /* }}} void varnish_monitor */
 
+/* Returns the next interval on the ladder around the global interval:
+ * divisors of "Interval" below it that are multiples of "MinInterval", and
+ * powers-of-two multiples above it. The read tick thus divides every slot
+ * and every poll stays on the configured interval grid. */
+static int varnish_interval_step (const user_config_t *conf, /* {{{ */
+		int direction)
+{
+	int base = interval_g;
+	int cur = conf->interval;
+	int i;
+
+	if (direction < 0)
+	{
+		if (cur > base)
+			return (cur / 2);
+
+		for (i = cur - 1; i >= conf->min_interval; i--)
+			if (((base % i) == 0) && ((i % conf->min_interval) == 0))
+				return (i);
+
+		return (cur);
+	}
+
+	if (direction > 0)
+	{
+		if (cur < base)
+		{
+			for (i = cur + 1; i < base; i++)
+				if (((base % i) == 0) && ((i % conf->min_interval) == 0))
+					return (i);
+
+			return (base);
+		}
+
+		if ((2 * cur) <= conf->max_interval)
+			return (2 * cur);
+
+		return (cur);
+	}
+
+	/* Drift back towards the configured interval. */
+	if (cur < base)
+		return (varnish_interval_step (conf, 1));
+	if (cur > base)
+		return (varnish_interval_step (conf, -1));
+
+	return (cur);
+} /* }}} int varnish_interval_step */
+
+#if HAVE_VARNISH_V2
+static void varnish_adapt_interval (user_config_t *conf, /* {{{ */
+		const struct varnish_stats *VSL_stats, time_t now)
+#endif
+#if HAVE_VARNISH_V3
+static void varnish_adapt_interval (user_config_t *conf,
+		const struct VSC_C_main *VSC_C_main, time_t now)
+#endif
+{
+	uint64_t client_req  = STAT_STRUCT->client_req;
+	uint64_t backend_fail = STAT_STRUCT->backend_fail;
+	uint64_t n_wrk_drop  = STAT_STRUCT->n_wrk_drop;
+	int direction = 0;
+
+	/* The tick divides every slot, so the read lags the slot that
+	 * scheduled it by a constant offset and the grid keeps rates exact. */
+	conf->poll_time = now - (now % conf->interval);
+
+	if (conf->last_poll == 0)
+	{
+		conf->last_req_rate = -1.0;
+	}
+	else if ((client_req < conf->last_client_req)
+			|| (backend_fail < conf->last_backend_fail)
+			|| (n_wrk_drop < conf->last_n_wrk_drop))
+	{
+		/* Counters went backwards: varnishd restarted. */
+		conf->interval = conf->min_interval;
+		conf->last_req_rate = -1.0;
+	}
+	else
+	{
+		time_t elapsed = conf->poll_time - conf->last_poll;
+		double req_rate;
+
+		if (elapsed < 1)
+			elapsed = 1;
+
+		req_rate = (double) (client_req - conf->last_client_req)
+			/ (double) elapsed;
+
+		if ((backend_fail != conf->last_backend_fail)
+				|| (n_wrk_drop != conf->last_n_wrk_drop))
+		{
+			/* Failures or drops: watch closely right away. */
+			conf->interval = conf->min_interval;
+		}
+		else
+		{
+			double delta = -1.0;
+
+			if (conf->last_req_rate >= 0.0)
+				delta = (req_rate > conf->last_req_rate)
+					? (req_rate - conf->last_req_rate)
+					: (conf->last_req_rate - req_rate);
+
+			if ((req_rate >= (double) conf->active_rate)
+					|| ((delta >= 1.0)
+						&& (delta > (conf->last_req_rate / 2.0))))
+				direction = -1;
+			else if (req_rate < ((double) conf->active_rate / 10.0))
+				direction = 1;
+
+			conf->interval = varnish_interval_step (conf, direction);
+		}
+
+		conf->last_req_rate = req_rate;
+	}
+
+	conf->last_poll = conf->poll_time;
+	conf->last_client_req = client_req;
+	conf->last_backend_fail = backend_fail;
+	conf->last_n_wrk_drop = n_wrk_drop;
+
+	conf->next_poll = now - (now % conf->interval) + conf->interval;
+} /* }}} void varnish_adapt_interval */
+
+/* Resolves the interval bounds against the global interval, which may
+ * not be known yet while the "Instance" block is being parsed. */
+static void varnish_adaptive_setup (user_config_t *conf) /* {{{ */
+{
+	const char *name = (conf->instance == NULL) ? "localhost" : conf->instance;
+	int i;
+
+	/* Snap to the largest divisor of "Interval" not above MinInterval. */
+	for (i = (conf->min_interval < interval_g) ? conf->min_interval : interval_g;
+			i > 1; i--)
+		if ((interval_g % i) == 0)
+			break;
+	if (conf->min_interval > interval_g)
+	{
+		WARNING ("Varnish plugin: \"MinInterval\" %i is above "
+				"\"Interval\" %i. Using %i for instance \"%s\".",
+				conf->min_interval, interval_g, i, name);
+		conf->min_interval = i;
+	}
+	else if (i != conf->min_interval)
+	{
+		WARNING ("Varnish plugin: \"MinInterval\" %i is not a divisor of "
+				"\"Interval\" %i. Using %i for instance \"%s\".",
+				conf->min_interval, interval_g, i, name);
+		conf->min_interval = i;
+	}
+
+	if (conf->max_interval == 0)
+	{
+		conf->max_interval = 4 * interval_g;
+	}
+	else if (conf->max_interval < interval_g)
+	{
+		WARNING ("Varnish plugin: \"MaxInterval\" %i is below "
+				"\"Interval\" %i. Using %i for instance \"%s\".",
+				conf->max_interval, interval_g, interval_g, name);
+		conf->max_interval = interval_g;
+	}
+	else
+	{
+		/* Round down to a power-of-two multiple of "Interval". */
+		for (i = interval_g; (2 * i) <= conf->max_interval; i *= 2)
+			/* nothing */;
+		if (i != conf->max_interval)
+		{
+			WARNING ("Varnish plugin: \"MaxInterval\" %i is not a "
+					"power-of-two multiple of \"Interval\" %i. "
+					"Using %i for instance \"%s\".",
+					conf->max_interval, interval_g, i, name);
+			conf->max_interval = i;
+		}
+	}
+
+	conf->interval = interval_g;
+} /* }}} void varnish_adaptive_setup */
+
 static int varnish_read (user_data_t *ud) /* {{{ */
 {
 #ifdef HAVE_VARNISH_V2
@@ -413,12 +627,18 @@ static int varnish_read (user_data_t *ud) /* {{{ */
 #endif
 
 	user_config_t *conf;
+	time_t now;
 
 	if ((ud == NULL) || (ud->data == NULL))
 		return (EINVAL);
 
 	conf = ud->data;
 
+	/* Called every "MinInterval" seconds; skip until our slot. */
+	now = time (NULL);
+	if (conf->adaptive_interval && (now < conf->next_poll))
+		return (0);
+
 #ifdef HAVE_VARNISH_V2
 	VSL_stats = VSL_OpenStats (conf->instance);
 	if (VSL_stats == NULL)
@@ -428,6 +648,9 @@ static int varnish_read (user_data_t *ud) /* {{{ */
 		return (-1);
 	}
 
+	if (conf->adaptive_interval)
+		varnish_adapt_interval (conf, VSL_stats, now);
+
 	varnish_monitor (conf, VSL_stats);
 #endif
 
@@ -443,6 +666,9 @@ static int varnish_read (user_data_t *ud) /* {{{ */
 
 	VSC_C_main = VSC_Main(vd);
 
+	if (conf->adaptive_interval)
+		varnish_adapt_interval (conf, VSC_C_main, now);
+
 	varnish_monitor (conf, VSC_C_main);
 	VSM_Delete(vd);
 #endif
@@ -480,13 +706,50 @@ static int varnish_config_apply_default (user_config_t *conf) /* {{{ */
 	conf->collect_sms         = 0;
 	conf->collect_totals      = 0;
 
+	conf->adaptive_interval   = 0;
+	conf->min_interval        = 1;
+	conf->max_interval        = 0;
+	conf->active_rate         = 100;
+
 	return (0);
 } /* }}} int varnish_config_apply_default */
 
+static void varnish_register_adaptive (user_config_t *conf) /* {{{ */
+{
+	user_data_t ud;
+	char callback_name[DATA_MAX_NAME_LEN];
+	struct timespec tick;
+
+	varnish_adaptive_setup (conf);
+
+	ssnprintf (callback_name, sizeof (callback_name), "varnish/%s",
+			(conf->instance == NULL) ? "localhost" : conf->instance);
+
+	ud.data = conf;
+	ud.free_func = varnish_config_free;
+
+	/* The callback ticks at "MinInterval" and varnish_read decides
+	 * whether this tick is due for a poll. */
+	memset (&tick, 0, sizeof (tick));
+	tick.tv_sec = conf->min_interval;
+
+	plugin_register_complex_read (/* group = */ "varnish",
+			/* name      = */ callback_name,
+			/* callback  = */ varnish_read,
+			/* interval  = */ &tick,
+			/* user data = */ &ud);
+} /* }}} void varnish_register_adaptive */
+
 static int varnish_init (void) /* {{{ */
 {
 	user_config_t *conf;
 	user_data_t ud;
+	size_t i;
+
+	for (i = 0; i < adaptive_instances_num; i++)
+		varnish_register_adaptive (adaptive_instances[i]);
+	sfree (adaptive_instances);
+	adaptive_instances_num = 0;
 
 	if (have_instance)
 		return (0);
@@ -518,6 +781,7 @@ static int varnish_config_instance (const oconfig_item_t *ci) /* {{{ */
 	user_config_t *conf;
 	user_data_t ud;
 	char callback_name[DATA_MAX_NAME_LEN];
+	_Bool have_adaptive_option = 0;
 	int i;
 
 	conf = malloc (sizeof (*conf));
@@ -583,6 +847,23 @@ static int varnish_config_instance (const oconfig_item_t *ci) /* {{{ */
 			cf_util_get_boolean (child, &conf->collect_totals);
 		else if (strcasecmp ("CollectWorkers", child->key) == 0)
 			cf_util_get_boolean (child, &conf->collect_workers);
+		else if (strcasecmp ("AdaptiveInterval", child->key) == 0)
+			cf_util_get_boolean (child, &conf->adaptive_interval);
+		else if (strcasecmp ("MinInterval", child->key) == 0)
+		{
+			cf_util_get_int (child, &conf->min_interval);
+			have_adaptive_option = 1;
+		}
+		else if (strcasecmp ("MaxInterval", child->key) == 0)
+		{
+			cf_util_get_int (child, &conf->max_interval);
+			have_adaptive_option = 1;
+		}
+		else if (strcasecmp ("ActiveRate", child->key) == 0)
+		{
+			cf_util_get_int (child, &conf->active_rate);
+			have_adaptive_option = 1;
+		}
 		else
 		{
 			WARNING ("Varnish plugin: Ignoring unknown "
@@ -612,6 +893,49 @@ static int varnish_config_instance (const oconfig_item_t *ci) /* {{{ */
 		return (EINVAL);
 	}
 
+	if (have_adaptive_option && !conf->adaptive_interval)
+	{
+		WARNING ("Varnish plugin: \"MinInterval\", \"MaxInterval\" and "
+				"\"ActiveRate\" are ignored for instance \"%s\" "
+				"unless \"AdaptiveInterval\" is enabled.",
+				(conf->instance == NULL) ? "localhost" : conf->instance);
+	}
+
+	if (conf->adaptive_interval && (conf->min_interval < 1))
+	{
+		WARNING ("Varnish plugin: \"MinInterval\" must be at least one "
+				"second. Using 1 for instance \"%s\".",
+				(conf->instance == NULL) ? "localhost" : conf->instance);
+		conf->min_interval = 1;
+	}
+
+	if (conf->adaptive_interval && (conf->active_rate <= 0))
+	{
+		WARNING ("Varnish plugin: \"ActiveRate\" must be positive. "
+				"Using 100 for instance \"%s\".",
+				(conf->instance == NULL) ? "localhost" : conf->instance);
+		conf->active_rate = 100;
+	}
+
+	if (conf->adaptive_interval)
+	{
+		user_config_t **tmp;
+
+		tmp = realloc (adaptive_instances, (adaptive_instances_num + 1)
+				* sizeof (*adaptive_instances));
+		if (tmp == NULL)
+		{
+			varnish_config_free (conf);
+			return (ENOMEM);
+		}
+		adaptive_instances = tmp;
+		adaptive_instances[adaptive_instances_num] = conf;
+		adaptive_instances_num++;
+
+		have_instance = 1;
+		return (0);
+	}
+
 	ssnprintf (callback_name, sizeof (callback_name), "varnish/%s",
 			(conf->instance == NULL) ? "localhost" : conf->instance);
 